@@ -201,6 +201,12 @@ int sws_scale(struct SwsContext *c, const uint8_t *const srcSlice[],
  * - sws_receive_slice(0, dst->height)
  * - sws_frame_end()
  *
+ * 译注(上游注释中没有此段):如果"threads" AVOption大于1(0表示根据CPU核心数
+ * 自动选择),输出帧会在内部被划分为多个水平切片,由多个线程并行缩放。每个切片
+ * 独立读取垂直滤波器所需的源行(包括与相邻切片重叠的部分),
+ * 因此调用者无需为每个切片创建单独的SwsContext。输出与单线程时完全相同。
+ * 此选项必须在sws_init_context()之前设置。
+ *
  * @param c   缩放上下文
  * @param dst 目标帧。更多详细信息请参见sws_frame_start()的文档。
  * @param src 源帧。